@@ -0,0 +1,55 @@
+// -*- mode: C++; c-basic-offset: 2; tab-width: 2; indent-tabs-mode: nil -*-
+
+// Copyright (C) 2007 - 2017 Robert Nielsen <robert@dakota.org>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+# pragma once
+
+# include <cstdio>
+# include <ctime>
+
+# include <dakota.h>
+
+inline FUNC bench_now_ns() -> int64_t {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return cast(int64_t)ts.tv_sec * 1000000000 + cast(int64_t)ts.tv_nsec;
+}
+inline FUNC bench_report(str_t name, int64_t start_ns, int64_t count) -> void {
+  int64_t elapsed_ns = bench_now_ns() - start_ns;
+  printf("{ \"bench\": \"%s\", \"count\": %lli, \"ns\": %lli, \"ns-per-op\": %.2f },\n",
+         name, cast(long long)count, cast(long long)elapsed_ns,
+         count ? cast(double)elapsed_ns / cast(double)count : 0.0);
+  return;
+}
+
+FUNC bench_alloc(int64_t count) -> void;
+FUNC bench_concurrent_hashed_table(int64_t count) -> void;
+FUNC bench_deque(int64_t count) -> void;
+FUNC bench_dispatch(int64_t count) -> void;
+FUNC bench_for_in(int64_t count) -> void;
+FUNC bench_hashed_set(int64_t count) -> void;
+FUNC bench_immediate(int64_t count) -> void;
+FUNC bench_json(int64_t count) -> void;
+FUNC bench_lexer(int64_t count) -> void;
+FUNC bench_instance_of(int64_t count) -> void;
+FUNC bench_intern(int64_t count) -> void;
+FUNC bench_make(int64_t count) -> void;
+FUNC bench_primitive_vector(int64_t count) -> void;
+FUNC bench_ref_count(int64_t count) -> void;
+FUNC bench_serialize(int64_t count) -> void;
+FUNC bench_sort(int64_t count) -> void;
+FUNC bench_sorted_set(int64_t count) -> void;
+FUNC bench_string(int64_t count) -> void;
+FUNC bench_thread_pool(int64_t count) -> void;
@@ -14,6 +14,8 @@ if [[ ${generator:-ninja} == make ]]; then
   generator_id="Unix Makefiles"
 fi
 extra_opts="-DCMAKE_BUILD_TYPE=Debug -Wdev -Wdeprecated"
+extra_opts="$extra_opts -DDKT_COMPRESSED_DISPATCH=${compressed_dispatch:-0}"
+extra_opts="$extra_opts -DDKT_REF_COUNT_STATS=${ref_count_stats:-0}"
 source_dir=$(pwd)
 mkdir -p $rel_build_dir
 cd $rel_build_dir
@@ -7,7 +7,7 @@ source_dir=$HOME/dakota
 rm -f bin/dakota-catalog$exe_suffix bin/dakota-find-library$exe_suffix
 rm -f lib/${lib_prefix}dakota-dso$lib_suffix lib/${lib_prefix}dakota-core$lib_suffix lib/${lib_prefix}dakota$lib_suffix
 rm -f dakota-core/build.mk dakota/build.mk
-rm -f tst1/build.mk tst2/build.mk
-rm -f tst1/exe$exe_suffix tst2/exe$exe_suffix
+rm -f tst1/build.mk tst2/build.mk bench/build.mk
+rm -f tst1/exe$exe_suffix tst2/exe$exe_suffix bench/exe$exe_suffix
 rm -fr $source_dir/z
 find . -name "*~" -exec rm -f {} \;
@@ -16,6 +16,7 @@ set (install-lib-dakota-files
   ${source_dir}/lib/dakota/util.pm
 )
 set (install-include-files
+  ${source_dir}/include/dakota-concurrent-hashed-table.h
   ${source_dir}/include/dakota-finally.h
   ${source_dir}/include/dakota-log.h
   ${source_dir}/include/dakota-object-defn.inc
@@ -23,6 +24,7 @@ set (install-include-files
   ${source_dir}/include/dakota-of.inc
   ${source_dir}/include/dakota-os.h
   ${source_dir}/include/dakota-other.inc
+  ${source_dir}/include/dakota-thread-pool.h
   ${source_dir}/include/dakota-weak-object-defn.inc
   ${source_dir}/include/dakota-weak-object.inc
   ${source_dir}/include/dakota.h
@@ -0,0 +1,96 @@
+// -*- mode: C++; c-basic-offset: 2; tab-width: 2; indent-tabs-mode: nil -*-
+
+// Copyright (C) 2007 - 2017 Robert Nielsen <robert@dakota.org>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+# pragma once
+
+# include <cstdint>
+# include <cstring>
+
+// Stable sort kernels for records ordered by an unsigned 64 bit key, so there
+// is no compare call per step.  A few records are insertion sorted; more are
+// LSD radix sorted a byte at a time, skipping the bytes all the keys share
+// (the high bytes of pointers and of small integers).  The records must be
+// trivially copyable.
+
+namespace dkt_sort {
+  struct keyed_t {
+    uint64_t         key;
+    object::slots_t* item;
+  };
+  const ssize_t k_insertion_max = 32;
+
+  // signed values (and addresses compared as intptr-t) in key order
+  inline FUNC signed_key(intptr_t value) -> uint64_t {
+    return cast(uint64_t)value ^ (cast(uint64_t)1 << 63);
+  }
+  template<typename t, typename key_of_t>
+  inline FUNC insertion_sort(t* items, ssize_t count, key_of_t key_of) -> void {
+    for (ssize_t i = 1; i < count; i++) {
+      t item = items[i];
+      uint64_t key = key_of(item);
+      ssize_t j = i;
+      for (; j > 0 && key < key_of(items[j - 1]); j--)
+        items[j] = items[j - 1];
+      items[j] = item;
+    }
+    return;
+  }
+  // scratch has room for count records
+  template<typename t, typename key_of_t>
+  inline FUNC radix_sort(t* items, t* scratch, ssize_t count, key_of_t key_of) -> void {
+    ssize_t counts[8][256] = {};
+    for (ssize_t i = 0; i < count; i++) {
+      uint64_t key = key_of(items[i]);
+      for (ssize_t b = 0; b < 8; b++)
+        counts[b][(key >> (8 * b)) & 0xff]++;
+    }
+    t* src = items;
+    t* dst = scratch;
+    for (ssize_t b = 0; b < 8; b++) {
+      ssize_t* offsets = counts[b];
+      if (offsets[(key_of(src[0]) >> (8 * b)) & 0xff] == count)
+        continue; // every key has this byte
+      ssize_t offset = 0;
+      for (ssize_t d = 0; d < 256; d++) {
+        ssize_t n = offsets[d];
+        offsets[d] = offset;
+        offset += n;
+      }
+      for (ssize_t i = 0; i < count; i++)
+        dst[offsets[(key_of(src[i]) >> (8 * b)) & 0xff]++] = src[i];
+      t* tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+    if (src != items)
+      memcpy(items, src, sizeof(t) * cast(size_t)count);
+    return;
+  }
+  template<typename t, typename key_of_t>
+  inline FUNC sort_by_key(t* items, ssize_t count, key_of_t key_of) -> void {
+    if (count <= k_insertion_max) {
+      insertion_sort(items, count, key_of);
+      return;
+    }
+    t* scratch = cast(t*)dkt::alloc(ssizeof(t) * count);
+    radix_sort(items, scratch, count, key_of);
+    dkt::dealloc(scratch);
+    return;
+  }
+}
+// sorts count (non-nullptr) items in place and stably by $compare()
+// (see vector.dk)
+FUNC dkt_sort_objects(object_t* items, ssize_t count) -> void;
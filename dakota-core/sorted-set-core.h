@@ -17,14 +17,17 @@
 # pragma once
 
 KLASS_NS sorted_set_core {
-  FUNC create(ssize_t capacity, ssize_t size, std_compare_t compare, bool_t is_ptr) -> slots_t*;
+  FUNC create(ssize_t capacity, ssize_t size, std_compare_t compare, bool_t is_ptr, bool_t is_tree) -> slots_t*;
   FUNC destroy(slots_t* slots) -> std::nullptr_t;
+  FUNC copy(const slots_t* t) -> slots_t*;
 
   FUNC add(slots_t* t, const void* key) -> const void*;
   FUNC add_at(slots_t* t, ssize_t offset, const void* key) -> const void*;
+  FUNC bulk_load(slots_t* t, ptr_t keys, ssize_t count) -> ssize_t;
 
   FUNC result_at(const slots_t* t, const void* key) -> result_t;
   FUNC at(const slots_t* t, ssize_t offset) -> const void*;
+  FUNC at_run(const slots_t* t, ssize_t offset, ssize_t* run) -> const void*;
 
   FUNC remove(slots_t* t, const void* key) -> const void*;
   FUNC remove_at(slots_t* t, ssize_t offset) -> const void*;
@@ -0,0 +1,90 @@
+// -*- mode: C++; c-basic-offset: 2; tab-width: 2; indent-tabs-mode: nil -*-
+
+// Copyright (C) 2007 - 2017 Robert Nielsen <robert@dakota.org>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+# pragma once
+
+# include <cstdint>
+# include <cstring>
+
+// The binary object stream format (written by binary-object-output-stream.dk,
+// read by binary-object-input-stream.dk).
+//
+//   file:    k_magic, then records
+//   records: k_klass_name index len bytes NUL  (the next klass name table entry)
+//            k_root id                         (an object passed to write())
+//            k_object id klass len levels      (an object and its slots)
+//   level:   k_slots klass len items           (what one klass's write-slots() wrote)
+//   items:   k_int zigzag | k_str len bytes NUL | k_idref id | k_klass_ref index |
+//            k_immediate index zigzag | k_nullptr | k_null |
+//            k_sequence_start items k_sequence_end | k_table_start items k_table_end
+//
+// Every number is a little endian base 128 varint.  The keys the text streams
+// write are dropped: a klass reads its items back in the order it wrote them.
+// A reader can skip a record or a level without looking at its items (so a
+// klass it cannot read, or items it does not read, cost nothing), and the
+// strings are NUL terminated in place (so they can be views of the buffer).
+
+namespace dkt_binary_object_stream {
+  const char_t k_magic[] = { 'd', 'k', 'o', 'b', 1 };
+  const ssize_t k_magic_len = sizeof(k_magic);
+  const ssize_t k_varint_max_len = 10;
+
+  enum tag_t : uint8_t {
+    k_klass_name = 1,
+    k_root,
+    k_object,
+    k_slots,
+    k_int,
+    k_str,
+    k_idref,
+    k_klass_ref,
+    k_immediate,
+    k_nullptr,
+    k_null,
+    k_sequence_start,
+    k_sequence_end,
+    k_table_start,
+    k_table_end
+  };
+  inline FUNC zigzag(int64_t value) -> uint64_t {
+    return (cast(uint64_t)value << 1) ^ cast(uint64_t)(value >> 63);
+  }
+  inline FUNC unzigzag(uint64_t value) -> int64_t {
+    return cast(int64_t)(value >> 1) ^ -cast(int64_t)(value & 1);
+  }
+  // p has room for k_varint_max_len bytes, returns the byte after the varint
+  inline FUNC put_varint(uint8_t* p, uint64_t value) -> uint8_t* {
+    while (value >= 0x80) {
+      *p++ = cast(uint8_t)(value | 0x80);
+      value >>= 7;
+    }
+    *p++ = cast(uint8_t)value;
+    return p;
+  }
+  // returns the byte after the varint, or nullptr if it is not complete before end
+  inline FUNC get_varint(const uint8_t* p, const uint8_t* end, uint64_t* value) -> const uint8_t* {
+    uint64_t result = 0;
+    for (int_t shift = 0; p < end && shift < 64; shift += 7) {
+      uint8_t byte = *p++;
+      result |= cast(uint64_t)(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        *value = result;
+        return p;
+      }
+    }
+    return nullptr;
+  }
+}
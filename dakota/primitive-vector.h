@@ -0,0 +1,232 @@
+// -*- mode: C++; c-basic-offset: 2; tab-width: 2; indent-tabs-mode: nil -*-
+
+// Copyright (C) 2007 - 2017 Robert Nielsen <robert@dakota.org>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+# pragma once
+
+# include <cstdint>
+# include <cstring>
+
+// Bulk kernels for the primitive vectors (only included by primitive-vector.dk).
+//
+// They are written with the gcc/clang vector extensions, 32 bytes at a time, so
+// they vectorize at any optimization level.  On x86-64 ELF targets each kernel
+// is also cloned for avx2 and the clone matching the cpu is bound at load time
+// (ifunc); elsewhere the generic vectors lower to sse2/neon.
+
+# if defined __x86_64__ && defined __ELF__ && (!defined __clang__ || __clang_major__ >= 14)
+  # define DKT_SIMD_CLONES __attribute__((target_clones("avx2", "default")))
+# else
+  # define DKT_SIMD_CLONES
+# endif
+
+// an item of any primitive vector (the kernels themselves are in a
+// primitive-vector-kernels-t, see primitive-vector.dk)
+union dkt_pv_scalar_t {
+  int64_t  i; // k-signed
+  uint64_t u; // k-unsigned
+  double   f; // k-float
+};
+
+// always inlined, so they are compiled for each clone's target (which also
+// makes passing the vectors by value abi neutral)
+# define DKT_PV_INLINE inline __attribute__((always_inline))
+
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace dkt_pv {
+  template<typename v_t, typename t>
+  DKT_PV_INLINE FUNC load(const t* items) -> v_t {
+    v_t v;
+    memcpy(&v, items, sizeof(v));
+    return v;
+  }
+  template<typename v_t, typename t>
+  DKT_PV_INLINE FUNC store(t* items, v_t v) -> void {
+    memcpy(items, &v, sizeof(v));
+    return;
+  }
+  template<typename m_t>
+  DKT_PV_INLINE FUNC any(m_t mask) -> bool {
+    typedef uint64_t u64x4_t __attribute__((vector_size(32)));
+    u64x4_t u = cast(u64x4_t)mask;
+    return (u[0] | u[1] | u[2] | u[3]) != 0;
+  }
+  // 8 items at a time, widened to the accumulator type
+  template<typename t, typename acc_t>
+  DKT_PV_INLINE FUNC sum(const t* items, ssize_t count) -> acc_t {
+    typedef t     tx8_t   __attribute__((vector_size(8 * sizeof(t))));
+    typedef acc_t accx8_t __attribute__((vector_size(8 * sizeof(acc_t))));
+    accx8_t acc = {};
+    ssize_t i = 0;
+    for (; i + 8 <= count; i += 8)
+      acc += __builtin_convertvector(load<tx8_t>(items + i), accx8_t);
+    acc_t result = 0;
+    for (ssize_t l = 0; l < 8; l++)
+      result += acc[l];
+    for (; i < count; i++)
+      result += cast(acc_t)items[i];
+    return result;
+  }
+  template<typename t, bool is_min>
+  DKT_PV_INLINE FUNC min_max(const t* items, ssize_t count) -> t {
+    typedef t v_t __attribute__((vector_size(32)));
+    const ssize_t lanes = sizeof(v_t) / sizeof(t);
+    t result = items[0];
+    ssize_t i = 0;
+    if (count >= lanes) {
+      v_t m = load<v_t>(items);
+      for (i = lanes; i + lanes <= count; i += lanes) {
+        v_t v = load<v_t>(items + i);
+        m = (is_min ? v < m : v > m) ? v : m;
+      }
+      for (ssize_t l = 0; l < lanes; l++)
+        if (is_min ? m[l] < result : m[l] > result)
+          result = m[l];
+    }
+    for (; i < count; i++)
+      if (is_min ? items[i] < result : items[i] > result)
+        result = items[i];
+    return result;
+  }
+  template<typename t>
+  DKT_PV_INLINE FUNC find(const t* items, ssize_t count, t item) -> ssize_t {
+    typedef t v_t __attribute__((vector_size(32)));
+    const ssize_t lanes = sizeof(v_t) / sizeof(t);
+    v_t key = v_t{} + item;
+    ssize_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+      if (any(load<v_t>(items + i) == key))
+        break;
+    for (; i < count; i++)
+      if (items[i] == item)
+        return i;
+    return -1;
+  }
+  template<typename t>
+  DKT_PV_INLINE FUNC count(const t* items, ssize_t count, t item) -> ssize_t {
+    typedef t v_t __attribute__((vector_size(32)));
+    typedef decltype(v_t{} == v_t{}) m_t; // lanes are 0 or -1
+    const ssize_t lanes = sizeof(v_t) / sizeof(t);
+    const ssize_t block = 127; // chunks before an 8 bit lane could overflow
+    v_t key = v_t{} + item;
+    ssize_t result = 0;
+    ssize_t i = 0;
+    while (i + lanes <= count) {
+      m_t acc = {};
+      for (ssize_t n = 0; n < block && i + lanes <= count; n++, i += lanes)
+        acc -= (load<v_t>(items + i) == key);
+      for (ssize_t l = 0; l < lanes; l++)
+        result += acc[l];
+    }
+    for (; i < count; i++)
+      if (items[i] == item)
+        result++;
+    return result;
+  }
+  template<typename t>
+  DKT_PV_INLINE FUNC fill(t* items, ssize_t count, t item) -> void {
+    typedef t v_t __attribute__((vector_size(32)));
+    const ssize_t lanes = sizeof(v_t) / sizeof(t);
+    v_t v = v_t{} + item;
+    ssize_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+      store(items + i, v);
+    for (; i < count; i++)
+      items[i] = item;
+    return;
+  }
+  template<typename t>
+  DKT_PV_INLINE FUNC compare(const t* items, const t* other_items, ssize_t count) -> cmp_t {
+    typedef t v_t __attribute__((vector_size(32)));
+    const ssize_t lanes = sizeof(v_t) / sizeof(t);
+    ssize_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+      if (any(load<v_t>(items + i) != load<v_t>(other_items + i)))
+        break;
+    for (; i < count; i++) {
+      if (items[i] < other_items[i])
+        return -1;
+      if (items[i] > other_items[i])
+        return 1;
+    }
+    return 0;
+  }
+  template<typename t>
+  DKT_PV_INLINE FUNC add_scalar(t* items, ssize_t count, t scalar) -> void {
+    typedef t v_t __attribute__((vector_size(32)));
+    const ssize_t lanes = sizeof(v_t) / sizeof(t);
+    v_t v = v_t{} + scalar;
+    ssize_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+      store(items + i, load<v_t>(items + i) + v);
+    for (; i < count; i++)
+      items[i] = cast(t)(items[i] + scalar);
+    return;
+  }
+}
+
+# pragma GCC diagnostic pop
+
+// the type erased (and, where supported, cpu dispatched) kernels for one item type
+# define DKT_PV_KERNELS(name, t, acc_t, k, member)                      \
+  DKT_SIMD_CLONES static FUNC dkt_pv_sum_##name(const void* items, ssize_t count, void* result) -> void { \
+    (cast(dkt_pv_scalar_t*)result)->member = dkt_pv::sum<t, acc_t>(cast(const t*)items, count); \
+  }                                                                     \
+  DKT_SIMD_CLONES static FUNC dkt_pv_min_##name(const void* items, ssize_t count, void* result) -> void { \
+    *cast(t*)result = dkt_pv::min_max<t, true>(cast(const t*)items, count); \
+  }                                                                     \
+  DKT_SIMD_CLONES static FUNC dkt_pv_max_##name(const void* items, ssize_t count, void* result) -> void { \
+    *cast(t*)result = dkt_pv::min_max<t, false>(cast(const t*)items, count); \
+  }                                                                     \
+  DKT_SIMD_CLONES static FUNC dkt_pv_find_##name(const void* items, ssize_t count, const void* item) -> ssize_t { \
+    return dkt_pv::find<t>(cast(const t*)items, count, *cast(const t*)item); \
+  }                                                                     \
+  DKT_SIMD_CLONES static FUNC dkt_pv_count_##name(const void* items, ssize_t count, const void* item) -> ssize_t { \
+    return dkt_pv::count<t>(cast(const t*)items, count, *cast(const t*)item); \
+  }                                                                     \
+  DKT_SIMD_CLONES static FUNC dkt_pv_fill_##name(void* items, ssize_t count, const void* item) -> void { \
+    dkt_pv::fill<t>(cast(t*)items, count, *cast(const t*)item);         \
+  }                                                                     \
+  DKT_SIMD_CLONES static FUNC dkt_pv_compare_##name(const void* items, const void* other_items, ssize_t count) -> cmp_t { \
+    return dkt_pv::compare<t>(cast(const t*)items, cast(const t*)other_items, count); \
+  }                                                                     \
+  DKT_SIMD_CLONES static FUNC dkt_pv_add_scalar_##name(void* items, ssize_t count, const void* scalar) -> void { \
+    dkt_pv::add_scalar<t>(cast(t*)items, count, *cast(const t*)scalar); \
+  }                                                                     \
+  static const primitive_vector_kernels_t dkt_pv_##name##_kernels = {   \
+    .size =       sizeof(t),                                            \
+    .kind =       k,                                                    \
+    .sum =        dkt_pv_sum_##name,                                    \
+    .min =        dkt_pv_min_##name,                                    \
+    .max =        dkt_pv_max_##name,                                    \
+    .find =       dkt_pv_find_##name,                                   \
+    .count =      dkt_pv_count_##name,                                  \
+    .fill =       dkt_pv_fill_##name,                                   \
+    .compare =    dkt_pv_compare_##name,                                \
+    .add_scalar = dkt_pv_add_scalar_##name,                             \
+  }
+
+DKT_PV_KERNELS(int8,    int8_t,    int64_t, primitive_vector_kind::k_signed,   i);
+DKT_PV_KERNELS(int16,   int16_t,   int64_t, primitive_vector_kind::k_signed,   i);
+DKT_PV_KERNELS(int32,   int32_t,   int64_t, primitive_vector_kind::k_signed,   i);
+DKT_PV_KERNELS(int64,   int64_t,   int64_t, primitive_vector_kind::k_signed,   i);
+DKT_PV_KERNELS(uint8,   uint8_t,   uint64_t, primitive_vector_kind::k_unsigned, u);
+DKT_PV_KERNELS(uint16,  uint16_t,  uint64_t, primitive_vector_kind::k_unsigned, u);
+DKT_PV_KERNELS(uint32,  uint32_t,  uint64_t, primitive_vector_kind::k_unsigned, u);
+DKT_PV_KERNELS(uint64,  uint64_t,  uint64_t, primitive_vector_kind::k_unsigned, u);
+DKT_PV_KERNELS(float32, float,     double,   primitive_vector_kind::k_float,    f);
+DKT_PV_KERNELS(float64, double,    double,   primitive_vector_kind::k_float,    f);
@@ -0,0 +1,98 @@
+// -*- mode: C++; c-basic-offset: 2; tab-width: 2; indent-tabs-mode: nil -*-
+
+// Copyright (C) 2007 - 2017 Robert Nielsen <robert@dakota.org>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+# pragma once
+
+# include <cstdint>
+# include <cstring>
+
+// Byte class scanners for the buffer based lexers.  Each returns the first
+// byte in [p, end) of its class, or end.  32 bytes are classified at a time
+// with the gcc/clang vector extensions (as in primitive-vector.h), which lower
+// to sse2/neon; only a block with a hit is rescanned a byte at a time.
+
+# define DKT_SCAN_INLINE inline __attribute__((always_inline))
+
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace dkt_scan {
+  typedef uint8_t  u8x32_t __attribute__((vector_size(32)));
+  typedef int8_t   m8x32_t __attribute__((vector_size(32))); // u8x32_t comparisons
+  typedef uint64_t u64x4_t __attribute__((vector_size(32)));
+
+  DKT_SCAN_INLINE FUNC load(const char_t* p) -> u8x32_t {
+    u8x32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+  }
+  DKT_SCAN_INLINE FUNC any(m8x32_t mask) -> bool {
+    u64x4_t words;
+    memcpy(&words, &mask, sizeof(words));
+    return (words[0] | words[1] | words[2] | words[3]) != 0;
+  }
+  // a byte class has both a vector (v) and a scalar (c) test
+  template<typename class_t>
+  DKT_SCAN_INLINE FUNC find(const char_t* p, const char_t* end, class_t in_class) -> const char_t* {
+    for (; end - p >= 32; p += 32)
+      if (any(in_class.v(load(p))))
+        break;
+    for (; p < end; p++)
+      if (in_class.c(cast(uint8_t)*p))
+        return p;
+    return end;
+  }
+  // not ' ', '\t', '\n', '\v', '\f' or '\r' (see isspace(3))
+  struct non_space_t {
+    DKT_SCAN_INLINE FUNC v(u8x32_t v) const -> m8x32_t {
+      return (v != ' ') & (cast(u8x32_t)(v - '\t') > 4);
+    }
+    DKT_SCAN_INLINE FUNC c(uint8_t c) const -> bool {
+      return c != ' ' && cast(uint8_t)(c - '\t') > 4;
+    }
+  };
+  // not [a-zA-Z0-9_-]
+  struct non_word_t {
+    DKT_SCAN_INLINE FUNC v(u8x32_t v) const -> m8x32_t {
+      return (cast(u8x32_t)((v | 0x20) - 'a') > 25) & (cast(u8x32_t)(v - '0') > 9) & (v != '-') & (v != '_');
+    }
+    DKT_SCAN_INLINE FUNC c(uint8_t c) const -> bool {
+      return cast(uint8_t)((c | 0x20) - 'a') > 25 && cast(uint8_t)(c - '0') > 9 && c != '-' && c != '_';
+    }
+  };
+  // quote or '\\'
+  struct quote_or_escape_t {
+    uint8_t quote;
+
+    DKT_SCAN_INLINE FUNC v(u8x32_t v) const -> m8x32_t {
+      return (v == quote) | (v == '\\');
+    }
+    DKT_SCAN_INLINE FUNC c(uint8_t c) const -> bool {
+      return c == quote || c == '\\';
+    }
+  };
+  inline FUNC find_non_space(const char_t* p, const char_t* end) -> const char_t* {
+    return find(p, end, non_space_t{});
+  }
+  inline FUNC find_non_word(const char_t* p, const char_t* end) -> const char_t* {
+    return find(p, end, non_word_t{});
+  }
+  inline FUNC find_quote_or_escape(const char_t* p, const char_t* end, char_t quote) -> const char_t* {
+    return find(p, end, quote_or_escape_t{cast(uint8_t)quote});
+  }
+}
+
+# pragma GCC diagnostic pop
@@ -0,0 +1,44 @@
+// -*- mode: C++; c-basic-offset: 2; tab-width: 2; indent-tabs-mode: nil -*-
+
+// Copyright (C) 2007 - 2017 Robert Nielsen <robert@dakota.org>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+# pragma once
+
+# include <sys/types.h>
+
+# include <atomic>
+# include <cstdint>
+# include <mutex>
+
+// A concurrent-hashed-table's shard (see concurrent-hashed-table.dk).  It is
+// not copyable, so it can not be a klass's slots, and it is a slot's type, so
+// it must be seen by the generated target.h (include-for), which includes it
+// ahead of dakota.h.
+
+namespace object { struct slots_t; }   // as in dakota.h
+struct concurrent_hashed_table_cells_t; // private to concurrent-hashed-table.dk
+
+struct concurrent_hashed_table_shard_t {
+  std::mutex                                    lock; // writers only
+  std::atomic<concurrent_hashed_table_cells_t*> cells;
+  std::atomic<ssize_t>                          size;
+  ssize_t                                       num_deleted;
+  std::atomic<int64_t>                          generation;
+  object::slots_t**                             retired; // unpublished pairs, each still holding a ref
+  ssize_t                                       retired_count;
+  ssize_t                                       retired_capacity;
+
+  alignas(64) std::atomic<ssize_t>              readers[2]; // apart from what writers touch
+};
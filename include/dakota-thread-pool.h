@@ -0,0 +1,52 @@
+// -*- mode: C++; c-basic-offset: 2; tab-width: 2; indent-tabs-mode: nil -*-
+
+// Copyright (C) 2007 - 2017 Robert Nielsen <robert@dakota.org>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+# pragma once
+
+# include <sys/types.h>
+
+# include <atomic>
+# include <condition_variable>
+# include <mutex>
+# include <thread>
+
+// The state behind a thread-pool's slots (see thread-pool.dk).  It is not
+// copyable, so it can not be a klass's slots, and it is a slot's type, so it
+// must be seen by the generated target.h (include-for).
+
+struct thread_pool_job_t; // private to thread-pool.dk
+
+struct thread_pool_task_t {
+  thread_pool_job_t* job;
+  ssize_t            begin;
+  ssize_t            end;
+};
+struct thread_pool_queue_t {
+  std::mutex          lock;
+  thread_pool_task_t* tasks; // [head, tail) are queued
+  ssize_t             head;
+  ssize_t             tail;
+  ssize_t             capacity;
+};
+struct thread_pool_state_t {
+  ssize_t                 workers;
+  thread_pool_queue_t*    queues; // workers + 1
+  std::thread*            threads;
+  std::atomic<ssize_t>    queued;
+  std::atomic<bool>       stopping;
+  std::mutex              idle_lock;
+  std::condition_variable idle;
+};
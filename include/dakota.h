@@ -16,7 +16,9 @@
 
 # pragma once
 
+# include <atomic>
 # include <cstddef>
+# include <cstdint>
 # include <cstdlib> // exit(), quick_exit()
 
 # define KLASS_NS namespace
@@ -122,7 +124,97 @@ KLASS_NS object { typealias slots_t = struct slots_t; }
 
 KLASS_NS ptr { typealias slots_t = void*; } typealias ptr_t = ptr::slots_t;
 
-# define OUT_OF_LINE_REF_COUNTING 1
+// build with -DOUT_OF_LINE_REF_COUNTING=0 to inline ref counting again
+# if !defined OUT_OF_LINE_REF_COUNTING
+  # define OUT_OF_LINE_REF_COUNTING 1
+# endif
+
+// build with -DDKT_REF_COUNT_STATS=1 to count add-ref()/remove-ref() calls
+# if !defined DKT_REF_COUNT_STATS
+  # define DKT_REF_COUNT_STATS 0
+# endif
+
+# if (DKT_REF_COUNT_STATS != 0)
+  struct dkt_ref_count_stats_t {
+    int64_t add_ref_count;
+    int64_t remove_ref_count;
+  };
+  [[so_export]] extern thread_local dkt_ref_count_stats_t dkt_ref_count_stats;
+  # define DKT_REF_COUNT_STAT(counter) dkt_ref_count_stats.counter++
+# else
+  # define DKT_REF_COUNT_STAT(counter)
+# endif
+
+// build with -DDKT_SINGLE_THREADED=1 to use plain (non-atomic) ref counts only
+# if !defined DKT_SINGLE_THREADED
+  # define DKT_SINGLE_THREADED 0
+# endif
+
+// biased ref counting: the thread that allocated an object (its owner) counts
+// in the plain biased field, all other threads count in the atomic shared field.
+// shared is (count << 2) | flags and goes negative when other threads release
+// references the owner created.  once merged the owner is nullptr and all
+// threads (including the former owner) count in shared.
+# if (DKT_SINGLE_THREADED != 0)
+  struct dkt_ref_count_t {
+    int_fast32_t biased;
+  };
+# else
+  struct dkt_ref_count_thread_t;
+  struct dkt_ref_count_t {
+    int_fast32_t                         biased; // only touched by the owner
+    std::atomic<int_fast32_t>            shared;
+    std::atomic<dkt_ref_count_thread_t*> owner;  // nullptr once merged
+  };
+  [[so_export]] extern thread_local dkt_ref_count_thread_t* dkt_ref_count_current_thread; // nullptr until first alloc
+
+  const int_fast32_t k_ref_count_shared_merged =           1 << 0;
+  const int_fast32_t k_ref_count_shared_queued =           1 << 1; // in the owner's merge queue
+  const int_fast32_t k_ref_count_shared_one =              1 << 2;
+  const int_fast32_t k_ref_count_shared_dealloc_initiated = INT_FAST32_MIN;
+# endif
+
+// build with -DDKT_TAGGED_IMMEDIATES=0 to heap allocate every boxed int64, ssize, int32 and char8.
+// otherwise values that fit live in the object-t itself: bit 0 is set, bits 1-2
+// index dkt-immediate-klasses[] and the rest is the value.  instances are at
+// least 16 byte aligned so a real instance pointer never has bit 0 set.
+# if !defined DKT_TAGGED_IMMEDIATES
+  # define DKT_TAGGED_IMMEDIATES 1
+# endif
+
+enum : int_t {
+  k_immediate_int64,
+  k_immediate_ssize,
+  k_immediate_int32,
+  k_immediate_char8,
+  k_immediate_klass_count
+};
+const int_t k_immediate_shift = 3;
+
+[[so_export]] extern object::slots_t* dkt_immediate_klasses[k_immediate_klass_count]; // set as each klass is initialized
+// initializes (and so registers) the klass, must be called before its first value is tagged
+[[so_export]] FUNC dkt_immediate_klass_init(int_t index) -> object::slots_t*;
+
+inline FUNC dkt_is_immediate(const object::slots_t* obj) -> bool_t {
+# if (DKT_TAGGED_IMMEDIATES != 0)
+  return (cast(uintptr_t)obj & 1) != 0;
+# else
+  cast(void)obj;
+  return false;
+# endif
+}
+inline FUNC dkt_immediate_fits(intptr_t value) -> bool_t {
+  return (cast(intptr_t)(cast(uintptr_t)value << k_immediate_shift) >> k_immediate_shift) == value;
+}
+inline FUNC dkt_immediate_box(int_t index, intptr_t value) -> object::slots_t* {
+  return cast(object::slots_t*)((cast(uintptr_t)value << k_immediate_shift) | (cast(uintptr_t)index << 1) | 1);
+}
+inline FUNC dkt_immediate_index(const object::slots_t* obj) -> int_t {
+  return cast(int_t)((cast(uintptr_t)obj >> 1) & 3);
+}
+inline FUNC dkt_immediate_value(const object::slots_t* obj) -> intptr_t {
+  return cast(intptr_t)obj >> k_immediate_shift;
+}
 
 # if (OUT_OF_LINE_REF_COUNTING == 0)
   # define REF_COUNTING_INLINE inline
@@ -141,7 +233,7 @@ static_assert(offsetof(weak_object_t, obj) == offsetof(object_t, obj),
 KLASS_NS boole        { typealias slots_t = bool_t;                                } typealias bool_t =         boole::slots_t;
 KLASS_NS cmp          { typealias slots_t = int_t;                                 } typealias cmp_t =          cmp::slots_t;
 KLASS_NS compare      { typealias slots_t = FUNC (*)(object_t, object_t) -> cmp_t; } typealias compare_t =      compare::slots_t;
-KLASS_NS generic_func { typealias slots_t = FUNC (*)(object_t) -> object_t;        } typealias generic_func_t = generic_func::slots_t;
+KLASS_NS generic_func { typealias slots_t = FUNC (*)(const object_t&) -> object_t; } typealias generic_func_t = generic_func::slots_t;
 KLASS_NS str          { typealias slots_t = const char_t*;                         } typealias str_t =          str::slots_t;
 KLASS_NS symbol       { typealias slots_t = str_t;                                 } typealias symbol_t =       symbol::slots_t;
 
@@ -24,6 +24,7 @@ dkt_declare_klass_type_struct(selector_node);
 FUNC import_selectors(signature_t** signatures, selector_node_t* selector_nodes) -> void;
 
 FUNC alloc_instance(ssize_t total_size, symbol_t kls_name, symbol_t instance_name = nullptr) -> object::slots_t*;
+FUNC register_trait(symbol_t name) -> void;
 # if defined DEBUG
 FUNC echo_stuff(object::slots_t* instance, str_t action, symbol_t kls_name, symbol_t instance_name = nullptr) -> void;
 # endif
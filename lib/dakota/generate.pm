@@ -102,6 +102,7 @@ my $global_scratch_str_ref;
 my $seq_super_t =   ['super-t']; # special (used in eq compare)
 my $seq_ellipsis =  ['...'];
 my $seq_object_t =  ['object-t'];
+my $seq_borrowed_object_t = ['const', 'object-t', '&'];
 my $seq_va_list_t = ['va-list-t'];
 my $object_t =  'object-t';
 my $super_t =   'super-t';
@@ -166,6 +167,39 @@ sub write_to_file_strings {
   &filestr_to_file($filestr, $path);
 }
 my $gbl_macros;
+# klass-name => [ kw-arg-name, ... ] for klasses whose init() takes only kw-args
+# and can be bound statically: $make(foo::klass()) always makes a foo, so only a
+# klass that is interposed or whose init() is aliased keeps the $init() dispatch
+# (being some other klass's superklass does not matter)
+my $gbl_kw_arg_klasses = {}; # target-inputs-ast => klass-name => [ kw-arg-name, ... ]
+sub kw_arg_klasses {
+  my ($target_inputs_ast) = @_;
+  return undef if !$target_inputs_ast;
+  return $$gbl_kw_arg_klasses{$target_inputs_ast} if $$gbl_kw_arg_klasses{$target_inputs_ast};
+  my $klasses = $$target_inputs_ast{'klasses'} || {};
+  my $not_bindable = {};
+  foreach my $kind ('interposers', 'interposers-unordered') {
+    foreach my $klass_name (keys %{$$target_inputs_ast{$kind} || {}}) {
+      $$not_bindable{$klass_name} = 1;
+    }
+  }
+  foreach my $klass_ast (values %$klasses) {
+    $$not_bindable{$$klass_ast{'interpose'}} = 1 if $$klass_ast{'interpose'};
+  }
+  my $result = {};
+  while (my ($klass_name, $klass_ast) = each(%$klasses)) {
+    next if $$not_bindable{$klass_name};
+    my $methods = [ values %{$$klass_ast{'methods'} || {}} ];
+    next if grep { $$_{'alias-src'} && ('init' eq &ct($$_{'name'}) || grep { 'init' eq $_ } @{$$_{'alias-src'}}) } @$methods;
+    foreach my $method (@$methods) {
+      next if 'init' ne &ct($$method{'name'});
+      next if !&num_kw_args($method) || 2 != @{$$method{'param-types'}};
+      $$result{$klass_name} = [ map { $$_{'name'} } @{$$method{'kw-args'}} ];
+    }
+  }
+  $$gbl_kw_arg_klasses{$target_inputs_ast} = $result;
+  return $result;
+}
 sub write_to_file_converted_strings {
   my ($path, $strings, $remove, $target_inputs_ast) = @_;
   if ($use_new_macro_system) {
@@ -190,7 +224,7 @@ sub write_to_file_converted_strings {
     &dakota::macro_system::macros_expand($sst, $gbl_macros, $kw_arg_generics);
   }
   my $converted_string = &sst_fragment::filestr($$sst{'tokens'});
-  &convert_dk_to_cc(\$converted_string, $kw_arg_generics, $remove); # costly (< 3/4 of total)
+  &convert_dk_to_cc(\$converted_string, $kw_arg_generics, $remove, &kw_arg_klasses($target_inputs_ast)); # costly (< 3/4 of total)
   my $should_echo;
   $should_echo = 1 if $path =~ /target($h_ext|$cc_ext)$/;
   # swap "# line 1" followed by "// -*- mode:" so the emacs mode line is first
@@ -703,6 +737,18 @@ sub arg_type::super {
   #}
   return $new_arg_type_ref;
 }
+# the generic func wrappers only forward their object-t args to the method
+# (which takes them by value), so they borrow them instead of copying them
+sub arg_type::borrowed {
+  my ($arg_type_ref) = @_;
+  my $new_arg_type_ref = &deep_copy($arg_type_ref);
+  foreach my $arg_type (@$new_arg_type_ref) {
+    if (0 == &type::compare($seq_object_t, $arg_type)) {
+      $arg_type = &deep_copy($seq_borrowed_object_t);
+    }
+  }
+  return $new_arg_type_ref;
+}
 sub arg_type::var_args {
   my ($arg_type_ref) = @_;
   my $num_args =       @$arg_type_ref;
@@ -1438,7 +1484,7 @@ sub generate_generic_defn {
   $$generic{'param-types'}[0] = $tmp;
   $new_arg_type =            $$generic{'param-types'};
   my $new_arg_names =           &arg_type::names($new_arg_type);
-  my $new_arg_list =            &arg_type::list_pair($new_arg_type, $new_arg_names);
+  my $new_arg_list =            &arg_type::list_pair(&arg_type::borrowed($new_arg_type), $new_arg_names);
   my $return_type = &arg::type($$generic{'return-type'});
   my $opt_va_open = '';
   my $opt_va_prefix = '';
@@ -1464,11 +1510,20 @@ sub generate_generic_defn {
     $col = &colin($col);
     $$scratch_str_ref .= $col . "typealias func-t = func (*)($$new_arg_type_list) -> $return_type;" . ' // no runtime cost' . $nl;
     $$scratch_str_ref .= $col . "static selector-t selector = selector($opt_va_prefix_method$generic_name($$new_arg_type_list));" . ' // one time initialization' . $nl;
+    $$scratch_str_ref .= "# if 0 != DKT-INLINE-CACHE-WAYS" . $nl;
+    $$scratch_str_ref .= $col . "static thread-local dkt-inline-cache-t cache = {};" . $nl;
+    if (&is_super($generic)) {
+      $$scratch_str_ref .= $col . "func-t _func_ = cast(func-t)dkt-inline-cache-lookup(&cache, klass::unbox(context.kls).superkls.obj, selector);" . $nl;
+    } else {
+      $$scratch_str_ref .= $col . "func-t _func_ = cast(func-t)dkt-inline-cache-lookup(&cache, dkt-klass-ptr-of(obj), selector);" . $nl;
+    }
+    $$scratch_str_ref .= "# else" . $nl;
     if (&is_super($generic)) {
-      $$scratch_str_ref .= $col . "func-t _func_ = cast(func-t)klass::unbox(superklass-of(context.kls)).methods.addrs[selector];" . $nl;
+      $$scratch_str_ref .= $col . "func-t _func_ = cast(func-t)dkt-method-for-selector(klass::unbox(superklass-of(context.kls)), selector);" . $nl;
     } else {
-      $$scratch_str_ref .= $col . "func-t _func_ = cast(func-t)klass::unbox(klass-of(obj)).methods.addrs[selector];" . $nl;
+      $$scratch_str_ref .= $col . "func-t _func_ = cast(func-t)dkt-method-for-selector(klass::unbox(klass-of(obj)), selector);" . $nl;
     }
+    $$scratch_str_ref .= "# endif" . $nl;
     my $arg_names_list;
     if ($big_generic) {
       my $arg_names = &deep_copy(&arg_type::names(&deep_copy($$generic{'param-types'})));
@@ -1508,6 +1563,7 @@ sub generate_generic_func_ptr_defn {
   my ($generic, $is_inline, $col, $ns) = @_;
   my $generic_name = $$generic{'name'}[0];
   my $list_types_str_ref = &arg_type::list_types($$generic{'param-types'});
+  my $borrowed_list_types_str_ref = &arg_type::list_types(&arg_type::borrowed($$generic{'param-types'}));
   my $return_type_str = &remove_extra_whitespace(join(' ', @{$$generic{'return-type'}}));
   my $in = &ident_comment($generic_name);
   my $opt_va_open = '';
@@ -1521,7 +1577,7 @@ sub generate_generic_func_ptr_defn {
     $opt_va_close = '}'
   }
   #namespace __generic-func-ptr { INLINE func add(object-t, object-t) -> generic-func-t* {
-  #  typealias func-t = func (*)(object-t, object-t) -> object-t; // no runtime cost
+  #  typealias func-t = func (*)(const object-t&, const object-t&) -> object-t; // no runtime cost
   #    static generic-func-t result = cast(generic-func-t)cast(func-t)__generic-func::add;
   #  return &result;
   #}}
@@ -1533,7 +1589,7 @@ sub generate_generic_func_ptr_defn {
   } elsif (&is_target_defn()) {
     $$scratch_str_ref .= $col . $part . " {" . $in . &ann(__FILE__, __LINE__) . $nl;
     $col = &colin($col);
-    $$scratch_str_ref .= $col . "typealias func-t = func (\*)($$list_types_str_ref) -> $return_type_str;" . ' // no runtime cost' . $nl;
+    $$scratch_str_ref .= $col . "typealias func-t = func (\*)($$borrowed_list_types_str_ref) -> $return_type_str;" . ' // no runtime cost' . $nl;
     $$scratch_str_ref .= $col . 'static generic-func-t result = cast(generic-func-t)cast(func-t)(__generic-func::' . $opt_va_prefix . $opt_name_prefix . $generic_name . ');' . $nl;
     $$scratch_str_ref .= $col . 'return &result;' . $nl;
     $col = &colout($col);
@@ -1562,9 +1618,10 @@ sub generate_generic_func_defn {
   my $new_arg_type =            $$generic{'param-types'};
   my $new_arg_type_list =   &arg_type::list_types($new_arg_type);
   $$generic{'param-types'}[0] = $tmp;
+  my $borrowed_list_types_str_ref = &arg_type::list_types(&arg_type::borrowed($$generic{'param-types'}));
   my $list_names = &arg_type::names($$generic{'param-types'});
   my $list_names_str = join(', ', @$list_names);
-  my $arg_list =  &arg_type::list_pair($$generic{'param-types'}, $list_names);
+  my $arg_list =  &arg_type::list_pair(&arg_type::borrowed($$generic{'param-types'}), $list_names);
   my $return_type_str = &remove_extra_whitespace(join(' ', @{$$generic{'return-type'}}));
   my $in = &ident_comment($generic_name);
   my $opt_va_open = '';
@@ -1579,8 +1636,8 @@ sub generate_generic_func_defn {
     $opt_name_prefix = '';
     $opt_va_close = '}'
   }
-  #namespace $ns { INLINE generic-func add(object-t arg0, object-t arg1) -> object-t {
-  #  typealias func-t = func (*)(object-t, object-t) -> object-t; // no runtime cost
+  #namespace $ns { INLINE generic-func add(const object-t& arg0, const object-t& arg1) -> object-t {
+  #  typealias func-t = func (*)(const object-t&, const object-t&) -> object-t; // no runtime cost
   #  func-t _func_ = cast(func-t)GENERIC-FUNC(add(object-t, object-t)); // static would be faster, but more rigid
   #  return _func_(arg0, arg1);
   #}}
@@ -1592,7 +1649,7 @@ sub generate_generic_func_defn {
   } elsif (&is_target_defn()) {
     $$scratch_str_ref .= $col . $part . " {" . $in . &ann(__FILE__, __LINE__) . $nl;
     $col = &colin($col);
-    $$scratch_str_ref .= $col . "typealias func-t = func (\*)($$list_types_str_ref) -> $return_type_str;" . ' // no runtime cost' . $nl;
+    $$scratch_str_ref .= $col . "typealias func-t = func (\*)($$borrowed_list_types_str_ref) -> $return_type_str;" . ' // no runtime cost' . $nl;
     $$scratch_str_ref .= $col . "DEBUG-STMT(static const signature-t* signature = signature($opt_va_prefix_method$generic_name($$new_arg_type_list)));" . ' // one time initialization' . $nl;
     $$scratch_str_ref .= $col . "DEBUG-STMT(dkt-current-signature = signature);" . $nl;
     if (&is_super($generic)) {
@@ -1880,6 +1937,12 @@ sub has_object_method_defn {
   }
   return $result;
 }
+# klasses whose box() returns a tagged immediate when the value fits (see
+# DKT-TAGGED-IMMEDIATES in dakota.h).  unbox() returns these by value.
+my $immediate_klasses = { 'int64' => 'k-immediate-int64',
+                          'ssize' => 'k-immediate-ssize',
+                          'int32' => 'k-immediate-int32',
+                          'char8' => 'k-immediate-char8' };
 sub generate_klass_unbox {
   my ($klass_path, $klass_name, $is_klass_defn) = @_;
   my $result = '';
@@ -1890,24 +1953,37 @@ sub generate_klass_unbox {
     ### unbox() same for all types
     my $klass_ast = &generics::klass_ast_from_klass_name($klass_name);
     if ($is_klass_defn || (&should_export_slots($klass_ast) && &has_slots_cat_info($klass_ast))) {
+      my $immediate = $$immediate_klasses{$klass_name};
       $result .= $col . "klass $klass_name { [[UNBOX-ATTRS]] INLINE func mutable-unbox($object_t obj) -> slots-t&";
       if (&is_src_decl() || &is_target_decl()) {
         $result .= "; }" . &ann(__FILE__, __LINE__) . $nl; # general-case
       } elsif (&is_target_defn()) {
         $result .=
           " {" . &ann(__FILE__, __LINE__) . $nl .
-          $col . "  DKT-UNBOX-CHECK(obj, _klass_); // optional" . $nl .
+          $col . "  DKT-UNBOX-CHECK(obj, _klass_); // optional" . $nl;
+        if ($immediate) {
+          $result .= $col . "  assert(!dkt-is-immediate(obj.obj)); // immediates can not be modified in place" . $nl;
+        }
+        $result .=
           $col . "  slots-t& s = *cast(slots-t*)(cast(intptr-t)obj + klass::unbox(_klass_).offset);" . $nl .
           $col . "  return s;" . $nl .
           $col . "}} // $klass_name\::mutable-unbox()" . $nl;
       }
-
-      $result .= $col . "klass $klass_name { [[UNBOX-ATTRS]] INLINE func unbox($object_t obj) -> const slots-t&";
+      my $unbox_return_type = 'const slots-t&';
+      if ($immediate) {
+        $unbox_return_type = 'slots-t';
+      }
+      $result .= $col . "klass $klass_name { [[UNBOX-ATTRS]] INLINE func unbox($object_t obj) -> $unbox_return_type";
       if (&is_src_decl() || &is_target_decl()) {
         $result .= "; }" . &ann(__FILE__, __LINE__) . $nl; # general-case
       } elsif (&is_target_defn()) {
+        $result .= " {" . &ann(__FILE__, __LINE__) . $nl;
+        if ($immediate) {
+          $result .=
+            $col . "  if (dkt-is-immediate(obj.obj))" . $nl .
+            $col . "    return cast(slots-t)dkt-immediate-value(obj.obj);" . $nl;
+        }
         $result .=
-          " {" . &ann(__FILE__, __LINE__) . $nl .
           $col . "  const slots-t& s = mutable-unbox(obj);" . $nl .
           $col . "  return s;" . $nl .
           $col . "}} // $klass_name\::unbox()" . $nl;
@@ -1994,6 +2070,19 @@ sub generate_klass_box {
         } elsif (&is_target_defn()) {
           $result .= " {" . &ann(__FILE__, __LINE__) . $nl;
           $col = &colin($col);
+          if (my $immediate = $$immediate_klasses{$klass_name}) {
+            # every value that fits is tagged, however early it is boxed (these
+            # klasses compare by identity, so equal values must box the same)
+            $result .=
+              "# if (DKT-TAGGED-IMMEDIATES != 0)" . $nl .
+              $col . "if (dkt-immediate-fits(cast(intptr-t)*arg)) {" . $nl .
+              $col . "  if (dkt-immediate-klasses[$immediate] == nullptr)" . $nl .
+              $col . "    dkt-immediate-klass-init($immediate);" . $nl .
+              $col . "  $object_t result = dkt-immediate-box($immediate, cast(intptr-t)*arg);" . $nl .
+              $col . "  return result;" . $nl .
+              $col . "}" . $nl .
+              "# endif" . $nl;
+          }
           if ($$klass_ast{'init-supports-kw-slots?'}) {
             my $kw_arg_name = $$klass_ast{'init-supports-kw-slots?'};
             my $type = "$klass_name\::slots-t";
@@ -2249,6 +2338,10 @@ sub linkage_unit::generate_klasses_body_funcs_non_inline {
       my ($visibility, $method_decl_ref) = &func::decl($method, $klass_path);
       if (&num_kw_args($method)) {
         $$scratch_str_ref .= $col . "$klass_type $klass_name" . $pad . " { namespace va {" . $visibility . " METHOD $$method_decl_ref }} //kw-args // stmt1" . &ann(__FILE__, __LINE__) . $nl;
+        my $bound_list_types = join(', ', @{&kw_args_method::bound_list_types($method)});
+        my $method_name = &ct($$method{'name'});
+        my $return_type = &arg::type($$method{'return-type'});
+        $$scratch_str_ref .= $col . "$klass_type $klass_name" . $pad . " { namespace kw {" . $visibility . " METHOD $method_name($bound_list_types) -> $return_type; }} //kw-args" . &ann(__FILE__, __LINE__) . $nl;
       } else {
         $$scratch_str_ref .= $col . "$klass_type $klass_name" . $pad . " { namespace va {" . $visibility . " METHOD $$method_decl_ref }} //va // stmt1" . &ann(__FILE__, __LINE__) . $nl;
       }
@@ -3717,10 +3810,148 @@ sub generate_kw_arg_method_defns {
   my ($slots, $methods, $klass_name, $col, $klass_type) = @_;
   foreach my $method (sort method::compare values %$methods) {
     if (&has_kw_args($method)) { # leave, don't change to num_kw_args() (link errors)
+      if (&num_kw_args($method)) {
+        &generate_kw_args_bound_method_defn($method, $klass_name, $col, $klass_type);
+      }
       &generate_kw_args_method_defn($slots, $method, $klass_name, $col, $klass_type);
     }
   }
 }
+# locals for the kw-args, plus which of them the caller supplied
+sub generate_kw_args_locals {
+  my ($method, $col, $is_bound) = @_;
+  my $scratch_str_ref = &global_scratch_str_ref();
+  $$scratch_str_ref .= $col;
+  my $delim = '';
+  foreach my $kw_arg (@{$$method{'kw-args'}}) {
+    my $kw_arg_name = $$kw_arg{'name'};
+    my $kw_arg_type = &arg::type($$kw_arg{'type'});
+    $kw_arg_type =~ s/\[\s*\]$/*/; # to change object-t[] objects to object-t* objects
+    if ($is_bound) {
+      $$scratch_str_ref .= "$delim$kw_arg_type $kw_arg_name = _${kw_arg_name}_.value;";
+    } else {
+      $$scratch_str_ref .= "$delim$kw_arg_type $kw_arg_name \{};";
+    }
+    $delim = ' ';
+  }
+  $$scratch_str_ref .= $nl;
+  $$scratch_str_ref .= $col . "struct {";
+  my $initializer = '';
+  $delim = '';
+  foreach my $kw_arg (@{$$method{'kw-args'}}) {
+    my $kw_arg_name = $$kw_arg{'name'};
+    $$scratch_str_ref .= " bool-t $kw_arg_name;";
+    if ($is_bound) {
+      $initializer .= "${delim}_${kw_arg_name}_.present";
+    } else {
+      $initializer .= "${delim}false";
+    }
+    $delim = ', ';
+  }
+  $$scratch_str_ref .= " } _state_ = { $initializer };" . $nl;
+}
+# fill in defaults (or throw for missing required kw-args) then call the positional method
+sub generate_kw_args_bind_and_call {
+  my ($method, $new_arg_names, $method_type_decl, $qualified_method_name, $col) = @_;
+  my $scratch_str_ref = &global_scratch_str_ref();
+  my $func_name = &ct($$method{'name'});
+  foreach my $kw_arg (@{$$method{'kw-args'}}) {
+    my $kw_arg_type =  &arg::type($$kw_arg{'type'});
+    my $kw_arg_name =    $$kw_arg{'name'};
+    $$scratch_str_ref .= $col . "unless (_state_.$kw_arg_name)" . $nl;
+    $col = &colin($col);
+    if (defined $$kw_arg{'default'}) {
+      my $kw_arg_default = $$kw_arg{'default'};
+      if ('nullptr' eq $kw_arg_default) {
+        $$scratch_str_ref .= $col . "$kw_arg_name = $kw_arg_default;" . $nl;
+      } elsif ($kw_arg_type =~ /\[\]$/ && $kw_arg_default =~ /^\{/) {
+        $$scratch_str_ref .= $col . "$kw_arg_name = cast($kw_arg_type)$kw_arg_default;" . $nl;
+      } else {
+        $$scratch_str_ref .= $col . "$kw_arg_name = cast(decltype($kw_arg_name))$kw_arg_default;" . $nl;
+      }
+    } else {
+      $$scratch_str_ref .=
+        $col . "throw \$make(missing-keyword-exception::klass()," . $nl .
+        $col . "            \#object$colon    self," . $nl .
+        $col . "            \#signature$colon __method-signature__," . $nl .
+        $col . "            \#keyword$colon   \#$kw_arg_name);" . $nl;
+    }
+    $col = &colout($col);
+  }
+  my $delim = '';
+  #my $last_arg_name = &remove_last($new_arg_names); # remove name associated with intptr-t type
+  my $args = '';
+
+  for (my $i = 0; $i < @$new_arg_names - 1; $i++) {
+    $args .= "$delim$$new_arg_names[$i]";
+    $delim = ', ';
+  }
+  #&add_last($new_arg_names, $last_arg_name); # add name associated with intptr-t type
+  foreach my $kw_arg (@{$$method{'kw-args'}}) {
+    my $kw_arg_name = $$kw_arg{'name'};
+    $args .= ", $kw_arg_name";
+  }
+  $$scratch_str_ref .= $col . "static func $method_type_decl = $qualified_method_name; //qualqual" . $nl;
+  if ($$method{'return-type'}) {
+    $$scratch_str_ref .=
+      $col . "auto _result_ = $func_name($args);" . $nl .
+      $col . "return _result_;" . $nl;
+  } else {
+    $$scratch_str_ref .=
+      $col . "$func_name($args);" . $nl .
+      $col . "return;" . $nl;
+  }
+}
+# positional params followed by one dkt::kw-arg-t<> per kw-arg, in declaration order
+sub kw_args_method::bound_list_types {
+  my ($method) = @_;
+  my $types = [];
+  my $param_types = $$method{'param-types'};
+  for (my $i = 0; $i < @$param_types - 1; $i++) {
+    &add_last($types, &arg::type($$param_types[$i]));
+  }
+  foreach my $kw_arg (@{$$method{'kw-args'}}) {
+    my $kw_arg_type = &arg::type($$kw_arg{'type'});
+    $kw_arg_type =~ s/\[\s*\]$/*/;
+    &add_last($types, "dkt::kw-arg-t<$kw_arg_type>");
+  }
+  return $types;
+}
+# fixed-arity twin of va::<method>: callers whose keyword set is known
+# statically (see rewrite_kw_arg_makes()) bind straight to the slots and
+# skip the va-arg keyword loop
+sub generate_kw_args_bound_method_defn {
+  my ($method, $klass_name, $col, $klass_type) = @_;
+  my $scratch_str_ref = &global_scratch_str_ref();
+  $method = &deep_copy($method);
+  my $qualified_klass_name = &ct($klass_name);
+  my $method_name = &ct($$method{'name'});
+  my $list_types = &arg_type::list_types($$method{'param-types'});
+  my $new_arg_names = &arg_type::names($$method{'param-types'});
+  &replace_first($new_arg_names, 'self');
+  my $types = &kw_args_method::bound_list_types($method);
+  my $names = [ @$new_arg_names[0 .. @$new_arg_names - 2] ];
+  foreach my $kw_arg (@{$$method{'kw-args'}}) {
+    &add_last($names, "_$$kw_arg{'name'}_");
+  }
+  my $arg_list = join(', ', map { "$$types[$_] $$names[$_]" } 0 .. @$types - 1);
+  my $return_type = &arg::type($$method{'return-type'});
+  my $visibility = '';
+  if (&is_exported($method)) {
+    $visibility = ' [[export]]';
+  }
+  $$scratch_str_ref .=
+    "$klass_type @$klass_name { namespace kw {" . $visibility . " METHOD $method_name($arg_list) -> $return_type { //kw-args" . &ann(__FILE__, __LINE__) . $nl;
+  $col = &colin($col);
+  $$scratch_str_ref .=
+    $col . "static const signature-t* __method-signature__ = KW-ARGS-METHOD-SIGNATURE(va::$method_name($$list_types)); USE(__method-signature__);" . $nl;
+  &generate_kw_args_locals($method, $col, 1);
+  $$method{'name'} = ['_func_'];
+  my $method_type_decl = &kw_args_method::type_decl($method);
+  &generate_kw_args_bind_and_call($method, $new_arg_names, $method_type_decl, "$qualified_klass_name\::$method_name", $col);
+  $col = &colout($col);
+  $$scratch_str_ref .= $col . "}}} // @$klass_name\::kw\::$method_name()" . $nl;
+}
 sub generate_kw_args_method_defn {
   my ($slots, $method, $klass_name, $col, $klass_type) = @_;
   my $scratch_str_ref = &global_scratch_str_ref();
@@ -3759,7 +3990,6 @@ sub generate_kw_args_method_defn {
     $col . "static const signature-t* __method-signature__ = KW-ARGS-METHOD-SIGNATURE(va::$method_name($$list_types)); USE(__method-signature__);" . $nl;
 
   $$method{'name'} = ['_func_'];
-  my $func_name = &ct($$method{'name'});
 
   #$$scratch_str_ref .=
   #  $col . "static const signature-t* __method-signature__ = KW-ARGS-METHOD-SIGNATURE(va::$method_name($$list_types)); USE(__method-signature__);" . $nl;
@@ -3781,26 +4011,7 @@ sub generate_kw_args_method_defn {
     &add_last($$method{'param-types'}, $param1);
   }
   if (&num_kw_args($method)) {
-    $$scratch_str_ref .= $col;
-    my $delim = '';
-    foreach my $kw_arg (@{$$method{'kw-args'}}) {
-      my $kw_arg_name = $$kw_arg{'name'};
-      my $kw_arg_type = &arg::type($$kw_arg{'type'});
-      $kw_arg_type =~ s/\[\s*\]$/*/; # to change object-t[] objects to object-t* objects
-      $$scratch_str_ref .= "$delim$kw_arg_type $kw_arg_name \{};";
-      $delim = ' ';
-    }
-    $$scratch_str_ref .= $nl;
-    $$scratch_str_ref .= $col . "struct {";
-    my $initializer = '';
-    $delim = '';
-    foreach my $kw_arg (@{$$method{'kw-args'}}) {
-      my $kw_arg_name = $$kw_arg{'name'};
-      $$scratch_str_ref .= " bool-t $kw_arg_name;";
-      $initializer .= "${delim}false";
-      $delim = ', ';
-    }
-    $$scratch_str_ref .= " } _state_ = { $initializer };" . $nl;
+    &generate_kw_args_locals($method, $col, 0);
   }
   #$$scratch_str_ref .= $col . "if (nullptr != $$new_arg_names[-1]) {" . $nl;
   #$col = &colin($col);
@@ -3840,52 +4051,7 @@ sub generate_kw_args_method_defn {
   $col = &colout($col);
   $$scratch_str_ref .= $col . "}" . $nl;
 
-  foreach my $kw_arg (@{$$method{'kw-args'}}) {
-    my $kw_arg_type =  &arg::type($$kw_arg{'type'});
-    my $kw_arg_name =    $$kw_arg{'name'};
-    $$scratch_str_ref .= $col . "unless (_state_.$kw_arg_name)" . $nl;
-    $col = &colin($col);
-    if (defined $$kw_arg{'default'}) {
-      my $kw_arg_default = $$kw_arg{'default'};
-      if ('nullptr' eq $kw_arg_default) {
-        $$scratch_str_ref .= $col . "$kw_arg_name = $kw_arg_default;" . $nl;
-      } elsif ($kw_arg_type =~ /\[\]$/ && $kw_arg_default =~ /^\{/) {
-        $$scratch_str_ref .= $col . "$kw_arg_name = cast($kw_arg_type)$kw_arg_default;" . $nl;
-      } else {
-        $$scratch_str_ref .= $col . "$kw_arg_name = cast(decltype($kw_arg_name))$kw_arg_default;" . $nl;
-      }
-    } else {
-      $$scratch_str_ref .=
-        $col . "throw \$make(missing-keyword-exception::klass()," . $nl .
-        $col . "            \#object$colon    self," . $nl .
-        $col . "            \#signature$colon __method-signature__," . $nl .
-        $col . "            \#keyword$colon   \#$kw_arg_name);" . $nl;
-    }
-    $col = &colout($col);
-  }
-  my $delim = '';
-  #my $last_arg_name = &remove_last($new_arg_names); # remove name associated with intptr-t type
-  my $args = '';
-
-  for (my $i = 0; $i < @$new_arg_names - 1; $i++) {
-    $args .= "$delim$$new_arg_names[$i]";
-    $delim = ', ';
-  }
-  #&add_last($new_arg_names, $last_arg_name); # add name associated with intptr-t type
-  foreach my $kw_arg (@{$$method{'kw-args'}}) {
-    my $kw_arg_name = $$kw_arg{'name'};
-    $args .= ", $kw_arg_name";
-  }
-  $$scratch_str_ref .= $col . "static func $method_type_decl = $qualified_klass_name\::$method_name; //qualqual" . $nl;
-  if ($$method{'return-type'}) {
-    $$scratch_str_ref .=
-      $col . "auto _result_ = $func_name($args);" . $nl .
-      $col . "return _result_;" . $nl;
-  } else {
-    $$scratch_str_ref .=
-      $col . "$func_name($args);" . $nl .
-      $col . "return;" . $nl;
-  }
+  &generate_kw_args_bind_and_call($method, $new_arg_names, $method_type_decl, "$qualified_klass_name\::$method_name", $col);
   $col = &colout($col);
   $$scratch_str_ref .= $col . "}}} // @$klass_name\::va\::$method_name()" . $nl;
   #&path::remove_last($klass_name);
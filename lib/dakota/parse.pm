@@ -998,10 +998,12 @@ my $last_for_first = { '<' => '>',
 sub include_for {
   my $seq = &dkdecl('include-for');
   my $index = 0;
-  my $last = $$last_for_first{$$seq[0]};
-  foreach my $part (@$seq) {
-    last if $last eq $part;
-    $index++;
+  if ($$seq[0] !~ m/^".*"$/) { # a "..." header is a single token
+    my $last = $$last_for_first{$$seq[0]};
+    foreach my $part (@$seq) {
+      last if $last eq $part;
+      $index++;
+    }
   }
   my $header_seq = [splice @$seq, 0, $index + 1];
   my $header = &ct($header_seq);
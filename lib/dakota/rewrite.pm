@@ -656,18 +656,24 @@ sub rewrite_supers {
 #    $$filestr_ref =~ s/make\(([_a-z0-9:-]+)/\$init(\$alloc($1)/g;
 #}
 my $dir2method_name = {
-  'forward'  => 'forward-iterator-next-lambda',
   'backward' => 'backward-iterator-next-lambda',
 };
 sub rewrite_for_in_replacement {
   my ($dir, $type, $item, $sequence, $ws1, $open_brace, $ws2, $stmt, $ws3) = @_;
   $dir = 'forward' if !$dir;
-  my $method_name = $$dir2method_name{$dir};
   my $first_stmt = '';
-  my $result = "for (iterator-next-lambda-t _f = \$$method_name($sequence);";
+  my $result;
+  if ('forward' eq $dir) {
+    # stack resident cursor filled by $next-n() (see iterator-cursor)
+    $result = "for (iterator-cursor-t _c = { $sequence };";
+  } else {
+    my $method_name = $$dir2method_name{$dir};
+    $result = "for (iterator-next-lambda-t _f = \$$method_name($sequence);";
+  }
+  my $next = ('forward' eq $dir) ? 'iterator-cursor::next(&_c)' : '_f()';
 
   if ('object-t' eq $type) {
-    $result .= " object-t $item = _f();";
+    $result .= " object-t $item = $next;";
     $result .= " /**/)";
     if (!$open_brace) { # $ws2 will be undefined
       $first_stmt .= "$ws1$stmt$ws3";
@@ -675,7 +681,7 @@ sub rewrite_for_in_replacement {
       $first_stmt .= "$ws1\{$ws2$stmt$ws3";
     }
   } elsif ('slots-t*' eq $type) {
-    $result .= " object-t $item = _f();";
+    $result .= " object-t $item = $next;";
     $result .= " /**/)";
 
     if (!$open_brace) { # $ws2 will be undefined
@@ -684,7 +690,7 @@ sub rewrite_for_in_replacement {
       $first_stmt .= "$ws1\{$ws2$type $item = mutable-unbox(_item_); $stmt$ws3";
     }
   } elsif ('auto' eq $type && $item =~ /^\[/) {
-    $result .= " object-t _item_ = _f();";
+    $result .= " object-t _item_ = $next;";
     $result .= " /**/)";
 
     if (!$open_brace) { # $ws2 will be undefined
@@ -694,7 +700,7 @@ sub rewrite_for_in_replacement {
     }
   } elsif ($type =~ m|($tid)|) {
     my $klass_name = $1;
-    $result .= " object-t _item_ = _f();";
+    $result .= " object-t _item_ = $next;";
     $result .= " /**/)";
     $klass_name =~ s/-t$//;
 
@@ -830,6 +836,62 @@ sub rewrite_keyword_use {
   #print STDERR "$arg1$list\n";
   return "$arg1$list";
 }
+# split on top-level commas
+sub split_args {
+  my ($str) = @_;
+  my $args = [];
+  my $depth = 0;
+  my $arg = '';
+  foreach my $ch (split //, $str) {
+    if (0 == $depth && ',' eq $ch) {
+      &add_last($args, $arg);
+      $arg = '';
+      next;
+    }
+    $depth++ if $ch =~ /[(\[{]/;
+    $depth-- if $ch =~ /[)\]}]/;
+    $arg .= $ch;
+  }
+  &add_last($args, $arg);
+  return $args;
+}
+# $make(foo::klass(), #x: 1, #z: 3)
+# make-kw(foo::klass(), foo::kw::init, 1, dkt::kw-absent, 3)
+sub kw_arg_make {
+  my ($list, $kw_arg_klasses) = @_;
+  my $inner = $list =~ s/^\(//r =~ s/\)$//r;
+  return undef if $inner =~ /\.\.\./;
+  my $args = &split_args($inner);
+  return undef unless $$args[0] =~ /^\s*($mid)::klass\(\)\s*$/;
+  my $klass_name = $1;
+  my $kw_arg_names = $$kw_arg_klasses{$klass_name} or return undef;
+  my $vals = {};
+  for (my $i = 1; $i < @$args; $i++) {
+    return undef unless $$args[$i] =~ /^\s*\#?($mid)\s*(?<!$colon)$colon(?!$colon)\s*(.*?)\s*$/s;
+    my ($name, $val) = ($1, $2);
+    return undef if exists $$vals{$name} || !grep { $_ eq $name } @$kw_arg_names;
+    $$vals{$name} = &rewrite_kw_arg_makes_str($val, $kw_arg_klasses);
+  }
+  my $result = "make-kw($$args[0], $klass_name\::kw::init";
+  foreach my $name (@$kw_arg_names) {
+    $result .= ', ' . (exists $$vals{$name} ? $$vals{$name} : 'dkt::kw-absent');
+  }
+  return $result . ')';
+}
+sub rewrite_kw_arg_makes_str {
+  my ($str, $kw_arg_klasses) = @_;
+  $str =~ s/\$make($main::list)/&kw_arg_make($1, $kw_arg_klasses) || "\$make$1"/ge;
+  return $str;
+}
+# $make() of a literal klass whose init() takes only kw-args is bound at
+# compile-time to the klass's fixed-arity kw::init() (no va-arg keyword loop),
+# but only for the klasses kw_arg_klasses() found not interposed and without an
+# aliased init()
+sub rewrite_kw_arg_makes {
+  my ($filestr_ref, $kw_arg_klasses) = @_;
+  return if !$kw_arg_klasses || !%$kw_arg_klasses;
+  $$filestr_ref = &rewrite_kw_arg_makes_str($$filestr_ref, $kw_arg_klasses);
+}
 sub rewrite_keyword_syntax {
   my ($filestr_ref, $kw_arg_generics) = @_;
   foreach my $name (keys %$kw_arg_generics) {
@@ -1019,7 +1081,7 @@ sub rewrite_xsymbol_syntax {
   $$filestr_ref =~ s/#\|($mid)\|/#$1/g;
 }
 sub convert_dk_to_cc {
-  my ($filestr_ref, $kw_arg_generics, $remove) = @_;
+  my ($filestr_ref, $kw_arg_generics, $remove, $kw_arg_klasses) = @_;
   &rewrite_literal_strs($filestr_ref);
   &encode_strings($filestr_ref);
   my $parts = &encode_comments($filestr_ref);
@@ -1081,6 +1143,7 @@ sub convert_dk_to_cc {
 
   &rewrite_signatures($filestr_ref);
   &rewrite_selectors($filestr_ref);
+  &rewrite_kw_arg_makes($filestr_ref, $kw_arg_klasses);
   &rewrite_keyword_syntax($filestr_ref, $kw_arg_generics);
   &rewrite_sentinel_generic_uses($filestr_ref, $kw_arg_generics);
   &rewrite_array_types($filestr_ref);
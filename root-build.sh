@@ -29,3 +29,5 @@ fi
 
 # generator=make;  rm -fr z && ./root-build.sh config && ./root-build.sh all && ./root-build.sh test
 # generator=ninja; rm -fr z && ./root-build.sh config && ./root-build.sh all && ./root-build.sh test
+# generator=ninja; rm -fr z && compressed_dispatch=1 ./root-build.sh config && ./root-build.sh all && ./root-build.sh test
+# generator=ninja; rm -fr z && ref_count_stats=1 ./root-build.sh config && ./root-build.sh all && bench/exe ref-count